@@ -0,0 +1,85 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+
+#ifndef WT_AUTH_HASHING_POOL_H_
+#define WT_AUTH_HASHING_POOL_H_
+
+#include <deque>
+#include <vector>
+
+#include <boost/function.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread.hpp>
+#include <boost/thread/condition.hpp>
+#endif // WT_THREADED
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+  namespace Auth {
+
+/*
+ * A bounded pool of threads for password hashing, which keeps
+ * expensive hash computations out of the threads that serve
+ * sessions.
+ *
+ * Jobs are queued up to a maximum number of pending jobs; a job that
+ * does not fit is refused. Jobs that are still queued when the pool
+ * is destroyed are cancelled.
+ */
+class HashingPool
+{
+public:
+  struct Statistics {
+    int pending;         // queued, not yet started
+    int active;          // being computed
+    int maxPending;      // high water mark of pending
+    long long completed;
+    long long rejected;
+  };
+
+  HashingPool();
+  ~HashingPool();
+
+  void setThreads(int threads);
+  int threads() const { return threads_; }
+
+  void setMaxPending(int count);
+  int maxPending() const { return maxPending_; }
+
+  // Returns false if the job was refused because the queue is full;
+  // cancel is called instead of job if it is never run
+  bool post(const boost::function<void ()>& job,
+	    const boost::function<void ()>& cancel);
+
+  Statistics statistics() const;
+
+private:
+  int threads_, maxPending_;
+
+#ifdef WT_THREADED
+  mutable boost::mutex mutex_;
+  boost::condition jobAvailable_;
+  std::vector<boost::thread *> workers_;
+#endif // WT_THREADED
+
+  struct Job {
+    boost::function<void ()> run, cancel;
+  };
+
+  std::deque<Job> jobs_;
+  bool stopping_;
+  Statistics stats_;
+
+  void run();
+};
+
+  }
+}
+
+#endif // WT_AUTH_HASHING_POOL_H_
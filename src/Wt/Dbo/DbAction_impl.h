@@ -379,7 +379,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
 
 	SqlStatement *statement;
 
-	statement = session()->getStatement(mapping().tableName, statementIdx);
+	statement = session()->getStatement(&mapping(), statementIdx);
 	{
 	  ScopedStatementUse use(statement);
 
@@ -403,7 +403,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
 	// Sql delete
 	++statementIdx;
 
-	statement = session()->getStatement(mapping().tableName, statementIdx);
+	statement = session()->getStatement(&mapping(), statementIdx);
 
 	{
 	  ScopedStatementUse use(statement);
@@ -505,6 +505,49 @@ void SaveDbAction<C>::visit(C& obj)
   }
 }
 
+template<class C>
+void SaveDbAction<C>::visitDependencies(C& obj)
+{
+  startDependencyPass();
+
+  persist<C>::apply(obj, *this);
+}
+
+template<class C>
+bool SaveDbAction<C>::bindBatchRow(C& obj, SqlStatement *statement,
+				   int& column)
+{
+  pass_ = Self;
+  needSetsPass_ = false;
+  isInsert_ = true;
+
+  statement_ = statement;
+  column_ = column;
+
+  if (mapping().versionFieldName)
+    statement_->bind(column_++, dbo_.version() + 1);
+
+  persist<C>::apply(obj, *this);
+
+  column = column_;
+
+  return needSetsPass_;
+}
+
+template<class C>
+void SaveDbAction<C>::batchRowDone(C& obj, long long id, bool needSetsPass)
+{
+  if (mapping().surrogateIdFieldName)
+    dbo_.setAutogeneratedId(id);
+
+  dbo_.setTransactionState(MetaDboBase::SavedInTransaction);
+
+  if (needSetsPass) {
+    startSetsPass();
+    persist<C>::apply(obj, *this);
+  }
+}
+
 template<class C>
 template<typename V>
 void SaveDbAction<C>::actId(V& value, const std::string& name, int size)
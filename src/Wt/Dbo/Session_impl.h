@@ -9,6 +9,7 @@
 
 #include <iostream>
 
+#include <Wt/Dbo/ObjectCache>
 #include <Wt/Dbo/SqlConnection>
 #include <Wt/Dbo/Query>
 
@@ -52,22 +53,25 @@ void Session::mapClass(const char *tableName)
   tableRegistry_[tableName] = mapping;
 }
 
+template <class C>
+void Session::setCacheable(bool cacheable)
+{
+  ClassRegistry::iterator i = classRegistry_.find(&typeid(C));
+  if (i != classRegistry_.end())
+    i->second->cacheable = cacheable;
+  else
+    throw Exception(std::string("Class ") + typeid(C).name()
+		    + " was not mapped.");
+}
+
 template <class C>
 SqlStatement *Session::getStatement(int statementIdx)
 {
   initSchema();
 
   ClassRegistry::iterator i = classRegistry_.find(&typeid(C));
-  MappingInfo *mapping = i->second;
-
-  std::string id = statementId(mapping->tableName, statementIdx);
-
-  SqlStatement *result = getStatement(id);
 
-  if (!result)
-    result = prepareStatement(id, mapping->statements[statementIdx]);
-
-  return result;
+  return getStatement(i->second, statementIdx);
 }
 
 template <class C>
@@ -257,6 +261,7 @@ void Session::implSave(MetaDbo<C>& dbo)
     transaction_->objects_.push_back(new ptr<C>(&dbo));
 
   Session::Mapping<C> *mapping = getMapping<C>();
+  invalidateObjectCache(mapping);
 
   SaveDbAction<C> action(dbo, *mapping);
   action.visit(*dbo.obj());
@@ -264,6 +269,143 @@ void Session::implSave(MetaDbo<C>& dbo)
   mapping->registry_[dbo.id()] = &dbo;
 }
 
+template<class C>
+void Session::implSaveBatch(MetaDbo<C>& dbo)
+{
+  if (!transaction_)
+    throw Exception("Dbo save(): no active transaction");
+
+  Session::Mapping<C> *mapping = getMapping<C>();
+
+  int maxRows = multiRowInsertLimit(mapping);
+
+  MetaDboBaseSet::iterator i
+    = dirtyObjects_.project<0>(dirtyObjects_.get<1>().find(&dbo));
+
+  if (maxRows < 2 || i == dirtyObjects_.end()) {
+    dbo.flush();
+    return;
+  }
+
+  /*
+   * Collect the pending inserts of this class, in flush order, up to
+   * the first object of this class that needs something else.
+   */
+  std::vector<MetaDbo<C> *> candidates;
+  for (; i != dirtyObjects_.end()
+	 && (int)candidates.size() < flushBatchSize_; ++i) {
+    MetaDbo<C> *other = dynamic_cast<MetaDbo<C> *>(*i);
+    if (other) {
+      if (!other->needsInsert())
+	break;
+      candidates.push_back(other);
+    }
+  }
+
+  /*
+   * Flush dependencies first: a candidate that is itself a dependency
+   * of another candidate is saved on its own, and drops out of the
+   * batch.
+   */
+  for (unsigned j = 0; j < candidates.size(); ++j)
+    if (candidates[j]->needsInsert()) {
+      SaveDbAction<C> action(*candidates[j], *mapping);
+      action.visitDependencies(*candidates[j]->obj());
+    }
+
+  std::vector<MetaDbo<C> *> batch;
+  for (unsigned j = 0; j < candidates.size(); ++j)
+    if (candidates[j]->needsInsert())
+      batch.push_back(candidates[j]);
+
+  unsigned start = 0;
+  while (start < batch.size()) {
+    /*
+     * Use full batches, and powers of two for the remainder, to limit
+     * the number of prepared statements.
+     */
+    int rows = std::min((int)(batch.size() - start), maxRows);
+    if (rows < maxRows) {
+      int r = 1;
+      while (r * 2 <= rows)
+	r *= 2;
+      rows = r;
+    }
+
+    SqlStatement *statement = 0;
+    if (rows > 1)
+      statement = getMultiRowInsertStatement(mapping, rows);
+
+    if (!statement) {
+      batch[start++]->flush();
+      continue;
+    }
+
+    invalidateObjectCache(mapping);
+
+    std::vector<bool> needSetsPass(rows);
+
+    for (int j = 0; j < rows; ++j) {
+      MetaDbo<C>& d = *batch[start + j];
+      transaction_->objects_.push_back(new ptr<C>(&d));
+      d.state_ &= ~MetaDboBase::NeedsSave;
+      d.state_ |= MetaDboBase::Saving;
+    }
+
+    try {
+      ScopedStatementUse use(statement);
+
+      statement->reset();
+      int column = 0;
+
+      for (int j = 0; j < rows; ++j) {
+	MetaDbo<C>& d = *batch[start + j];
+	SaveDbAction<C> action(d, *mapping);
+	needSetsPass[j] = action.bindBatchRow(*d.obj(), statement, column);
+      }
+
+      statement->execute();
+
+      /*
+       * The generated ids are matched with the rows in the order in
+       * which they are returned. A sequence hands out increasing ids in
+       * the order of the values list, which is what we check.
+       */
+      std::vector<long long> ids(rows, -1);
+      if (mapping->surrogateIdFieldName) {
+	for (int j = 0; j < rows; ++j)
+	  if (!statement->nextRow() || !statement->getResult(0, &ids[j])
+	      || (j > 0 && ids[j] <= ids[j - 1]))
+	    throw Exception("Dbo save(): unexpected auto-generated ids for "
+			    + std::string(mapping->tableName));
+
+	if (statement->nextRow())
+	  throw Exception("Dbo save(): unexpected auto-generated ids for "
+			  + std::string(mapping->tableName));
+      }
+
+      for (int j = 0; j < rows; ++j) {
+	MetaDbo<C>& d = *batch[start + j];
+
+	SaveDbAction<C> action(d, *mapping);
+	action.batchRowDone(*d.obj(), ids[j], needSetsPass[j]);
+
+	mapping->registry_[d.id()] = &d;
+      }
+    } catch (...) {
+      for (int j = 0; j < rows; ++j)
+	batch[start + j]->setTransactionState(MetaDboBase::SavedInTransaction);
+      throw;
+    }
+
+    start += rows;
+  }
+
+  for (unsigned j = 0; j < batch.size(); ++j)
+    if (batch[j] != &dbo)
+      discardChanges(batch[j]);
+}
+
 template<class C>
 void Session::implDelete(MetaDbo<C>& dbo)
 {
@@ -274,7 +416,10 @@ void Session::implDelete(MetaDbo<C>& dbo)
   if (!dbo.savedInTransaction())
     transaction_->objects_.push_back(new ptr<C>(&dbo));
 
-  bool versioned = getMapping<C>()->versionFieldName && dbo.obj() != 0;
+  Session::Mapping<C> *mapping = getMapping<C>();
+  invalidateObjectCache(mapping);
+
+  bool versioned = mapping->versionFieldName && dbo.obj() != 0;
   SqlStatement *statement
     = getStatement<C>(versioned ? SqlDeleteVersioned : SqlDelete);
 
@@ -305,7 +450,19 @@ void Session::implDelete(MetaDbo<C>& dbo)
 template<class C>
 void Session::implTransactionDone(MetaDbo<C>& dbo, bool success)
 {
-  TransactionDoneAction action(dbo, *this, *getMapping<C>(), success);
+  Session::Mapping<C> *mapping = getMapping<C>();
+
+  /*
+   * Invalidate again after commit or rollback: another session may
+   * have cached values that it read before our changes were committed.
+   */
+  if (mapping->flushedInTransaction) {
+    if (objectCache_)
+      objectCache_->invalidate(mapping->tableName);
+    mapping->flushedInTransaction = false;
+  }
+
+  TransactionDoneAction action(dbo, *this, *mapping, success);
   action.visit(*dbo.obj());
 }
 
@@ -315,7 +472,14 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   if (!transaction_)
     throw Exception("Dbo load(): no active transaction");
 
-  LoadDbAction<C> action(dbo, *getMapping<C>(), statement, column);
+  Session::Mapping<C> *mapping = getMapping<C>();
+
+  if (!statement && useObjectCache(mapping)) {
+    implLoadCached(dbo, *mapping);
+    return;
+  }
+
+  LoadDbAction<C> action(dbo, *mapping, statement, column);
 
   C *obj = new C();
   try {
@@ -327,6 +491,59 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   }
 }
 
+template<class C>
+void Session::implLoadCached(MetaDbo<C>& dbo, Mapping<C>& mapping)
+{
+  std::string id = boost::lexical_cast<std::string>(dbo.id());
+
+  Impl::CachedRowPtr row = objectCache_->get(mapping.tableName, id);
+
+  if (row) {
+    Impl::CachedRowStatement replay(row);
+    int column = 0;
+    implLoad(dbo, &replay, column);
+    return;
+  }
+
+  /*
+   * Read the generation before querying, so that the values are not
+   * cached if the table is modified meanwhile.
+   */
+  long long generation = objectCache_->generation(mapping.tableName);
+
+  SqlStatement *statement = getStatement<C>(SqlSelectById);
+  ScopedStatementUse use(statement);
+  statement->reset();
+
+  int column = 0;
+  dbo.bindId(statement, column);
+
+  statement->execute();
+
+  if (!statement->nextRow())
+    throw ObjectNotFoundException(id);
+
+  Impl::CachedRowStatement recorder(statement);
+  column = 0;
+  implLoad(dbo, &recorder, column);
+
+  if (statement->nextRow())
+    throw Exception("Dbo load: multiple rows for id " + id + " ??");
+
+  objectCache_->put(mapping.tableName, id, generation, recorder.row());
+}
+
+template<class C>
+void Session::implUncache(MetaDbo<C>& dbo)
+{
+  if (objectCache_) {
+    Mapping<C> *mapping = getMapping<C>();
+    if (mapping->cacheable)
+      objectCache_->remove(mapping->tableName,
+			   boost::lexical_cast<std::string>(dbo.id()));
+  }
+}
+
 template <class C>
 Session::Mapping<C>::~Mapping()
 {
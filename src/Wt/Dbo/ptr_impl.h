@@ -96,6 +96,17 @@ void MetaDbo<C>::flush()
   }
 }
 
+template <class C>
+void MetaDbo<C>::flushBatched()
+{
+  checkNotOrphaned();
+
+  if (needsInsert())
+    session()->implSaveBatch(*this);
+  else
+    flush();
+}
+
 template <class C>
 void MetaDbo<C>::bindId(SqlStatement *statement, int& column)
 {
@@ -179,6 +190,7 @@ void MetaDbo<C>::reread()
   checkNotOrphaned();
   if (isPersisted()) {
     session()->discardChanges(this);
+    session()->implUncache(*this);
 
     delete obj_;
     obj_ = 0;
@@ -12,6 +12,7 @@
 #include <string>
 #else
 #include <pango/pango.h>
+#include <boost/shared_ptr.hpp>
 #endif // HAVE_PANGO
 
 #include <Wt/WPaintDevice>
@@ -151,10 +152,19 @@ public:
    */
   void addFontCollection(const std::string& directory, bool recursive = true);
 
+#ifdef HAVE_PANGO
+  /*
+   * Configures whether text in simple scripts is measured using the
+   * cached glyph metrics, rather than by laying out the whole text.
+   */
+  void setGlyphCacheEnabled(bool enabled) { glyphCacheEnabled_ = enabled; }
+#endif // HAVE_PANGO
+
 private:
   WPaintDevice *device_;
 
 #ifdef HAVE_PANGO
+  bool glyphCacheEnabled_;
 
   PangoContext *context_;
   PangoFont *currentFont_;
@@ -167,6 +177,19 @@ private:
   GList *layoutText(const WFont& font, const std::string& utf8,
 		    std::vector<PangoGlyphString *>& glyphs, int& width);
 
+  /*
+   * Glyph metrics (advances and kerning), cached process-wide for
+   * each font and measuring device type.
+   */
+  struct GlyphMetrics;
+  class GlyphMetricsCache;
+
+  static GlyphMetricsCache& glyphMetricsCache();
+  boost::shared_ptr<GlyphMetrics> glyphMetrics(const WFont& font);
+  double measureWidth(const WFont& font, const std::string& utf8);
+  double textWidth(const WFont& font, GlyphMetrics& metrics,
+		   const char *begin, const char *end);
+
   friend class FontMatch;
 
 #else 
@@ -70,6 +70,7 @@ public:
 		     double cellHeight = -1);
 
   void render(WTextRenderer& renderer, int page);
+  void computePageRange();
 
   static void clearFloats(PageState &ps);
   static void clearFloats(PageState &ps,
@@ -105,6 +106,7 @@ private:
   BlockList children_;
   double currentWidth_;
   double contentsHeight_;
+  int firstPage_, lastPage_; // pages on which this block (or a child) is laid out
   mutable std::map<std::string, std::string> css_;
 
   std::string attributeValue(const char *attribute) const;
@@ -177,6 +179,9 @@ private:
   double minChildrenLayoutY(int page) const;
   double childrenLayoutHeight(int page) const;
   void reLayout(const BlockBox& from, const BlockBox& to);
+  void includePage(int page);
+  bool isOnPage(int page) const
+    { return page >= firstPage_ && page <= lastPage_; }
 
   void renderText(const std::string& text, WTextRenderer& renderer, int page);
   void renderBorders(const LayoutBox& bb, WTextRenderer& renderer,
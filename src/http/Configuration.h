@@ -51,6 +51,9 @@ public:
   const std::string& pidPath() const { return pidPath_; }
   const std::string& serverName() const { return serverName_; }
   bool compression() const { return compression_; }
+  int webSocketDeflateWindowBits() const { return wsDeflateWindowBits_; }
+  int webSocketDeflateMemLevel() const { return wsDeflateMemLevel_; }
+  bool sendFile() const { return sendFile_; }
   bool gdb() const { return gdb_; }
   const std::string& configPath() const { return configPath_; }
 
@@ -72,9 +75,14 @@ public:
 
   const std::string& sessionIdPrefix() const { return sessionIdPrefix_; }
   const std::string& accessLog() const { return accessLog_; }
+  int accessLogBufferSize() const { return accessLogBufferSize_; }
 
   ::int64_t maxMemoryRequestSize() const { return maxMemoryRequestSize_; }
 
+  ::int64_t staticCacheSize() const { return staticCacheSize_; }
+  ::int64_t staticCacheMaxFileSize() const { return staticCacheMaxFileSize_; }
+  int staticCacheValidation() const { return staticCacheValidation_; }
+
 private:
   Wt::WLogger& logger_;
   bool silent_;
@@ -88,6 +96,8 @@ private:
   std::string pidPath_;
   std::string serverName_;
   bool compression_;
+  int wsDeflateWindowBits_, wsDeflateMemLevel_;
+  bool sendFile_;
   bool gdb_;
   std::string configPath_;
 
@@ -107,9 +117,14 @@ private:
 
   std::string sessionIdPrefix_;
   std::string accessLog_;
+  int accessLogBufferSize_;
 
   ::int64_t maxMemoryRequestSize_;
 
+  ::int64_t staticCacheSize_;
+  ::int64_t staticCacheMaxFileSize_;
+  int staticCacheValidation_;
+
   void createOptions(po::options_description& options);
   void readOptions(const po::variables_map& vm);
 
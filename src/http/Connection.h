@@ -63,6 +63,9 @@ public:
   /// Like CGI's Url scheme: http or https
   virtual std::string urlScheme() = 0;
 
+  /// Whether reply content may be sent directly from a file (sendfile()).
+  virtual bool canSendFile() { return false; }
+
   virtual ~Connection();
 
   Server *server() const { return server_; }
@@ -75,6 +78,8 @@ public:
 public: // huh?
   void handleWriteResponse(const asio_error_code& e);
   void handleWriteResponse();
+  void handleWriteFile(const asio_error_code& e,
+		       std::size_t bytes_transferred);
   void startWriteResponse();
   void handleReadRequest(const asio_error_code& e,
 			 std::size_t bytes_transferred);
@@ -116,6 +121,13 @@ private:
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout) = 0;
 
+  /*
+   * Asynchronously writing (part of) a file region, only called when
+   * canSendFile()
+   */
+  virtual void startAsyncWriteFile(const Reply::FileRegion& region,
+				   int timeout);
+
   /// The handler used to process the incoming request.
   RequestHandler& request_handler_;
 
@@ -98,6 +98,16 @@ public:
     pong = 0xA,
   };
 
+  /*
+   * A region of an open file, which a connection may transmit directly
+   * from the file (using sendfile()) instead of through content buffers.
+   */
+  struct FileRegion {
+    int fd;
+    ::int64_t offset;
+    ::int64_t length;
+  };
+
   virtual void consumeData(Buffer::const_iterator begin,
 			   Buffer::const_iterator end,
 			   Request::State state) = 0;
@@ -107,8 +117,16 @@ public:
 				       Buffer::const_iterator end,
 				       Request::State state);
 
+  /*
+   * Compresses outgoing WebSocket messages with permessage-deflate
+   * (RFC 7692). Returns false if this reply does not send messages.
+   */
+  virtual bool setWebSocketDeflate(int windowBits, bool noContextTakeover);
+
   void setConnection(ConnectionPtr connection);
   bool nextBuffers(std::vector<asio::const_buffer>& result);
+  bool nextFileRegion(FileRegion& result);
+  void fileRegionSent(::int64_t size);
   bool closeConnection() const;
   void setCloseConnection() { closeConnection_ = true; }
 
@@ -123,6 +141,9 @@ public:
   void setStatus(status_type status);
   status_type status() const { return status_; }
 
+  static std::string httpDate(time_t t);
+  static bool isCompressible(const std::string& contentType);
+
 protected:
   const Request& request_;
   const Configuration& configuration_;
@@ -136,11 +157,11 @@ protected:
   virtual ::int64_t contentLength() = 0;
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result) = 0;
+  virtual bool nextContentFileRegion(FileRegion& result);
+  virtual void contentFileRegionSent(::int64_t size);
 
   void setRelay(ReplyPtr reply);
 
-  static std::string httpDate(time_t t);
-
   ConnectionPtr getConnection() { return connection_.lock(); }
   bool transmitting() const { return transmitting_; }
 
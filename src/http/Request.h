@@ -18,7 +18,6 @@
 #define HTTP_REQUEST_HPP
 
 #include <string>
-#include <map>
 #include <vector>
 #include <boost/cstdint.hpp>
 #include <boost/algorithm/string.hpp>
@@ -37,20 +36,6 @@ namespace Wt {
 namespace http {
 namespace server {
 
-/*
- * boost::is_iless throws bad_cast -- here is my ad hoc version.
- */
-struct my_iless
-{
-  bool operator()(const std::string& a, const std::string& b) const {
-#if defined(WIN32) && !defined(__CYGWIN__)
-    return _stricmp(a.c_str(), b.c_str()) < 0;
-#else
-    return strcasecmp(a.c_str(), b.c_str()) < 0;
-#endif
-  }
-};
-
 /// A request received from a client.
 /// A request with a body will have a content-length.
 class Request
@@ -58,6 +43,23 @@ class Request
 public:
   enum State { Partial, Complete, Error };
 
+  struct Header {
+    std::string name;
+    std::string value;
+  };
+
+  /// Headers used by wthttp itself, which are indexed while parsing.
+  enum HeaderId {
+    AcceptEncodingHeader,
+    ConnectionHeader,
+    ContentLengthHeader,
+    CookieHeader,
+    UpgradeHeader,
+    HeaderIdCount
+  };
+
+  Request();
+
   std::string method;
   std::string uri;
   std::string urlScheme;
@@ -66,9 +68,6 @@ public:
   int http_version_major;
   int http_version_minor;
 
-  typedef std::map<std::string, std::string, my_iless> HeaderMap;
-  HeaderMap headerMap;
-  std::vector<HeaderMap::iterator> headerOrder;
   ::int64_t contentLength;
   int webSocketVersion;
 
@@ -86,9 +85,56 @@ public:
   bool closeConnection() const;
   bool acceptGzipEncoding() const;
   void enableWebSocket();
-  std::string getHeader(const std::string& name) const;
+  const std::string *getHeader(const char *name) const;
+  const std::string *getHeader(HeaderId id) const;
+
+  std::size_t headerCount() const { return headerCount_; }
+  const Header& header(std::size_t i) const { return headers_[i]; }
+
+  // used by the RequestParser
+  Header& addHeader();
+  Header& lastHeader() { return headers_[headerCount_ - 1]; }
+  Header& continueHeader();
+  void headerComplete();
 
   void transmitHeaders(std::ostream& out) const;
+
+private:
+  /*
+   * The header slots are reused by subsequent requests on the same
+   * connection, and thus also the memory held by their strings.
+   */
+  std::vector<Header> headers_;
+  std::size_t headerCount_;
+  int headerIndex_[HeaderIdCount];
+
+  /*
+   * The header that the last header line was stored in: this is not
+   * lastHeader() when it was merged with an earlier header of the same
+   * name. A continuation line is folded into this header.
+   */
+  std::size_t completedHeader_;
+  bool continuation_;
+
+  /*
+   * A case-insensitive hash table (with open addressing) of the other
+   * headers, which maps a name to its header slot. It is reused by
+   * subsequent requests too: a slot is empty unless it was filled
+   * during the current generation (i.e. request).
+   */
+  struct HeaderSlot {
+    unsigned generation;
+    std::size_t header;
+  };
+
+  std::vector<HeaderSlot> headerTable_;
+  std::size_t headerTableCount_;
+  unsigned generation_;
+
+  static HeaderId headerId(const char *name);
+  static std::size_t headerHash(const char *name);
+  int findHeader(const char *name, std::size_t hash) const;
+  void indexHeader(std::size_t header, std::size_t hash);
 };
 
 } // namespace server
@@ -31,6 +31,7 @@ namespace server {
 
 class Configuration;
 class Request;
+class StaticFileCache;
 
 /// The common handler for all incoming requests.
 class RequestHandler
@@ -40,7 +41,8 @@ public:
   /// Construct with a directory containing files to be served.
   explicit RequestHandler(const Configuration &config,
 			  const Wt::EntryPointList& entryPoints,
-			  Wt::WLogger& logger);
+			  Wt::WLogger& logger,
+			  StaticFileCache *staticFileCache = 0);
 
   /// Handle a request and produce a reply.
   ReplyPtr handleRequest(Request& req);
@@ -59,6 +61,8 @@ private:
   const Wt::EntryPointList& entryPoints_;
   /// The logger
   Wt::WLogger& logger_;
+  /// The cache for static files, or 0 when disabled
+  StaticFileCache *staticFileCache_;
 
   /// Perform URL-decoding on a string and separates in path and
   /// query. Returns false if the encoding was invalid.
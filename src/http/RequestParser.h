@@ -36,6 +36,8 @@ public:
   /// Construct ready to parse the request method.
   RequestParser(Server *server);
 
+  ~RequestParser();
+
   /// Reset to initial parser state.
   void reset();
 
@@ -73,16 +75,28 @@ private:
 
   bool consumeChar(char input);
   void consumeToString(std::string& result, int maxSize);
+  void consumeAppendToString(std::string& result, int maxSize);
+  bool consumeRun(Buffer::iterator& begin, Buffer::iterator end);
   void consumeComplete();
 
   Request::State parseWebSocketMessage(Request& req, ReplyPtr reply,
 				       Buffer::iterator& begin,
 				       Buffer::iterator end);
+  bool consumeWebSocketData(ReplyPtr reply,
+			    Buffer::iterator begin, Buffer::iterator end,
+			    Request::State state);
 
   bool doWebSocketHandshake00(const Request& req);
   std::string doWebSocketHandshake13(const Request& req);
   bool parseCrazyWebSocketKey(const std::string& key, ::uint32_t& number);
 
+#ifdef WTHTTP_WITH_ZLIB
+  std::string negotiateWebSocketDeflate(const Request& req, ReplyPtr reply);
+  bool inflateWebSocketData(Buffer::iterator begin, Buffer::iterator end,
+			    bool lastData);
+  bool inflateWebSocketData(unsigned char *data, std::size_t length);
+#endif // WTHTTP_WITH_ZLIB
+
   Server *server_;
 
   /// The current state of the request parser.
@@ -126,13 +140,22 @@ private:
     ws13_payload
   } wsState_;
 
-  // used for ws00 frameType or ws13 opcode byte
+  // used for ws00 frameType or ws13 opcode byte (of the current message)
   unsigned char wsFrameType_;
+  // ws13 opcode byte of the current frame if it is a control frame, or 0
+  unsigned char wsControlFrameType_;
   unsigned char wsCount_;
   unsigned wsMask_;
 
-  std::string  headerName_;
-  std::string  headerValue_;
+#ifdef WTHTTP_WITH_ZLIB
+  // permessage-deflate: decompression context, which is kept for the
+  // whole connection
+  bool wsInflate_;
+  bool wsCompressed_;
+  z_stream wsInflateStrm_;
+  std::string wsInflated_;
+  ::int64_t wsInflatedSize_;
+#endif // WTHTTP_WITH_ZLIB
 
   ::uint64_t   requestSize_;
 
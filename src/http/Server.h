@@ -36,6 +36,7 @@ namespace asio = boost::asio;
 #include "Configuration.h"
 #include "ConnectionManager.h"
 #include "RequestHandler.h"
+#include "StaticFileCache.h"
 
 #include "Wt/WLogger"
 
@@ -74,6 +75,8 @@ public:
 
   const Configuration &configuration() { return config_; }
 
+  const StaticFileCache &staticFileCache() const { return staticFileCache_; }
+
   asio::io_service &service();
 
 private:
@@ -131,6 +134,9 @@ void handleTimeout(asio::deadline_timer *timer,
   /// The next TCP connection to be accepted.
   TcpConnectionPtr new_tcpconnection_;
 
+  /// The cache for static files, used by the request handler.
+  StaticFileCache staticFileCache_;
+
   /// The handler for all incoming requests.
   RequestHandler request_handler_;
 };
@@ -0,0 +1,120 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_STATIC_FILE_CACHE_HPP
+#define HTTP_STATIC_FILE_CACHE_HPP
+
+#include <time.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+// For ::int64_t and ::uint64_t on Windows only
+#include "Wt/WDllDefs.h"
+
+namespace http {
+namespace server {
+
+class Configuration;
+
+/// A static file, loaded in memory by the StaticFileCache.
+struct StaticFile
+{
+  time_t lastWriteTime;
+  std::string data;
+  std::string modifiedDate;
+  std::string etag;
+
+  /// Compressed variant: either the ".gz" file on disk or compressed
+  /// while loading the file. Empty when there is no compressed variant.
+  time_t gzipLastWriteTime;
+  std::string gzipData;
+  std::string gzipModifiedDate;
+  std::string gzipETag;
+
+  ::int64_t memoryUsage() const { return data.size() + gzipData.size(); }
+};
+
+typedef boost::shared_ptr<const StaticFile> StaticFilePtr;
+
+/// A bounded, least-recently-used cache of static files.
+/*
+ * Files are kept together with their headers and a compressed
+ * variant. Cached entries are validated against the file's
+ * modification time at most once every validation interval.
+ */
+class StaticFileCache
+  : private boost::noncopyable
+{
+public:
+  struct Statistics {
+    ::int64_t hits;
+    ::int64_t misses;
+    ::int64_t evictions;
+    ::int64_t size;
+    int files;
+  };
+
+  explicit StaticFileCache(const Configuration& config);
+
+  bool enabled() const { return maxSize_ > 0; }
+
+  /// Returns the file, or a null pointer if it cannot be cached.
+  StaticFilePtr get(const std::string& path, const std::string& contentType);
+
+  Statistics statistics() const;
+
+private:
+  typedef std::list<std::string> LruList;
+
+  struct Entry {
+    StaticFilePtr file;
+    time_t validated;
+    LruList::iterator lru;
+  };
+
+  typedef std::map<std::string, Entry> EntryMap;
+
+  const Configuration& config_;
+  ::int64_t maxSize_, maxFileSize_;
+  int validationInterval_;
+
+#ifdef WT_THREADED
+  mutable boost::mutex mutex_;
+#endif // WT_THREADED
+
+  EntryMap entries_;
+  LruList lru_; // most recently used first
+  ::int64_t size_;
+
+  ::int64_t hits_, misses_, evictions_;
+
+  StaticFilePtr load(const std::string& path, time_t lastWriteTime,
+		     time_t gzipLastWriteTime, const std::string& contentType);
+
+  void insert(const std::string& path, StaticFilePtr file, time_t now);
+  void remove(EntryMap::iterator i);
+  void touch(Entry& entry);
+
+  static bool readFile(const std::string& path, std::string& result);
+#ifdef WTHTTP_WITH_ZLIB
+  static bool compress(const std::string& data, std::string& result);
+#endif // WTHTTP_WITH_ZLIB
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_STATIC_FILE_CACHE_HPP
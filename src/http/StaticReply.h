@@ -24,6 +24,7 @@
 namespace asio = boost::asio;
 
 #include "Reply.h"
+#include "StaticFileCache.h"
 
 namespace http {
 namespace server {
@@ -35,7 +36,9 @@ class StaticReply : public Reply
 {
 public:
   StaticReply(const std::string &full_path, const std::string &extension,
-	      const Request& request, const Configuration& configuration);
+	      const Request& request, const Configuration& configuration,
+	      StaticFileCache *cache = 0);
+  virtual ~StaticReply();
 
   virtual void consumeData(Buffer::const_iterator begin,
 			   Buffer::const_iterator end,
@@ -46,15 +49,22 @@ protected:
   virtual ::int64_t contentLength();
 
   virtual void nextContentBuffers(std::vector<asio::const_buffer>& result);
+  virtual bool nextContentFileRegion(FileRegion& result);
+  virtual void contentFileRegionSent(::int64_t size);
 
 private:
   std::string     path_;
   std::string     extension_;
   std::ifstream   stream_;
   ::int64_t fileSize_;
+  int fd_; // for sendfile(), opened on demand
 
   char buf_[64 * 1024];
 
+  StaticFilePtr file_;           // when served from the cache
+  const std::string *content_;   // file_'s data or gzip'ed data
+  ::int64_t contentPos_;
+
   std::string computeModifiedDate() const;
   std::string computeETag() const;
   static std::string computeExpires();
@@ -46,15 +46,22 @@ public:
 
   virtual void stop();
   virtual std::string urlScheme() { return "http"; }
+  virtual bool canSendFile();
 
 protected:
   virtual void startAsyncReadRequest(Buffer& buffer, int timeout);
   virtual void startAsyncReadBody(Buffer& buffer, int timeout);
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout);
+  virtual void startAsyncWriteFile(const Reply::FileRegion& region,
+				   int timeout);
 
   /// Socket for the connection.
   asio::ip::tcp::socket socket_;
+
+private:
+  void handleWriteFileReady(const Reply::FileRegion& region,
+			    const asio_error_code& e);
 };
 
 typedef boost::shared_ptr<TcpConnection> TcpConnectionPtr;
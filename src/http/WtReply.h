@@ -44,6 +44,8 @@ public:
 				       Buffer::const_iterator end,
 				       Request::State state);
 
+  virtual bool setWebSocketDeflate(int windowBits, bool noContextTakeover);
+
   void setContentLength(::int64_t length);
   void setContentType(const std::string& type);
   void setLocation(const std::string& location);
@@ -76,6 +78,14 @@ protected:
 
   char gatherBuf_[16];
 
+#ifdef WTHTTP_WITH_ZLIB
+  bool wsDeflate_, wsDeflateNoContextTakeover_;
+  z_stream wsDeflateStrm_;
+  std::string wsDeflated_;
+
+  void deflateWebSocketMessage();
+#endif // WTHTTP_WITH_ZLIB
+
   virtual std::string     contentType();
   virtual std::string     location();
   virtual ::int64_t       contentLength();
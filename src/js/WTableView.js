@@ -356,6 +356,95 @@ WT_DECLARE_WT_MEMBER
      }
    };
 
+   /*
+    * Client-side rendering of cells (see
+    * WTableView::setClientSideRendering()): each column container
+    * holds one plain div per rendered row, and divs of rows that
+    * scroll out of view are reused for rows that scroll into view.
+    */
+   /** @const */ var MaxSpareCells = 1000;
+
+   var spareCells = [];
+
+   function newCell(height) {
+     var cell = spareCells.pop();
+     if (!cell)
+       cell = document.createElement('div');
+     cell.className = 'Wt-tv-c';
+     cell.style.height = height;
+     return cell;
+   }
+
+   function alignCells(column, firstRow, lastRow) {
+     var cfr = column.wtFirstRow, clr, height = rowHeight() + 'px';
+
+     if (typeof cfr === 'undefined')
+       cfr = firstRow;
+     clr = cfr + column.childNodes.length - 1;
+
+     for (; cfr < firstRow && cfr <= clr; ++cfr)
+       spareCells.push(column.removeChild(column.firstChild));
+     for (; clr > lastRow && clr >= cfr; --clr)
+       spareCells.push(column.removeChild(column.lastChild));
+
+     if (clr < cfr) {
+       cfr = firstRow;
+       clr = firstRow - 1;
+     }
+
+     for (; cfr > firstRow; --cfr)
+       column.insertBefore(newCell(height), column.firstChild);
+     for (; clr < lastRow; ++clr)
+       column.appendChild(newCell(height));
+
+     column.wtFirstRow = firstRow;
+
+     if (spareCells.length > MaxSpareCells)
+       spareCells.length = MaxSpareCells;
+   }
+
+   function setCell(cell, value) {
+     if (value instanceof Array) {
+       cell.className = 'Wt-tv-c ' + value[1];
+       value = value[0];
+     } else
+       cell.className = 'Wt-tv-c';
+
+     $(cell).text(value);
+   }
+
+   /*
+    * blocks: [ [ firstRow, [ columnId, ... ], [ [ cell, ... ], ... ] ], ... ]
+    */
+   this.updateCells = function(firstRow, lastRow, blocks) {
+     var tables = [ contentsContainer.firstChild.firstChild,
+		    headerColumnsContainer.firstChild.firstChild ],
+         columns = {}, column, i, il, j, jl, k, kl;
+
+     for (i = 0; i < 2; ++i)
+       for (column = tables[i].firstChild; column;
+	    column = column.nextSibling) {
+	 columns[column.className.split(' ')[0].substring(7)] = column;
+	 alignCells(column, firstRow, lastRow);
+       }
+
+     for (i = 0, il = blocks.length; i < il; ++i) {
+       var block = blocks[i], ids = block[1], rows = block[2];
+
+       for (j = 0, jl = ids.length; j < jl; ++j) {
+	 column = columns[ids[j]];
+	 if (!column)
+	   continue;
+
+	 for (k = 0, kl = rows.length; k < kl; ++k) {
+	   var cell = column.childNodes[block[0] + k - firstRow];
+	   if (cell)
+	     setCell(cell, rows[k][j]);
+	 }
+       }
+     }
+   };
+
    this.autoJavaScript = function() {
      if (el.parentNode == null) {
        el = contentsContainer = headerContainer = null;
@@ -5,6 +5,6 @@ A||d.scrollTop>B||d.scrollLeft<y||d.scrollLeft>z))r.emit(i,"scrolled",d.scrollLe
 e;e=-k;k=-g}new f.SizeHandle(f,"h",a.offsetWidth,i.offsetHeight,e,k,"Wt-hsh",function(h){G(c,h)},a,i,b,-2,-1)};this.scrolled=function(a,b,c,e){y=a;z=b;A=c;B=e};this.resetScroll=function(){o.scrollLeft=v;d.scrollLeft=v;d.scrollTop=u;p.scrollTop=u};this.scrollTo=function(a,b,c){if(b!=-1){a=d.scrollTop;var e=d.clientHeight;if(c==0)if(a+e<b)c=1;else if(b<a)c=2;switch(c){case 1:d.scrollTop=b;break;case 2:d.scrollTop=b-(e-C());break;case 3:d.scrollTop=b-(e-C())/2;break}d.onscroll()}};var q=null;i.handleDragDrop=
 function(a,b,c,e,k){if(q){q.className=q.classNameOrig;q=null}if(a!="end"){var g=w(c);if(!g.selected&&g.drop)if(a=="drop")r.emit(i,{name:"dropEvent",eventObject:b,event:c},g.rowIdx,g.columnId,e,k);else{b.className="Wt-valid-drop";q=g.el;q.classNameOrig=q.className;q.className+=" Wt-drop-site"}else b.className=""}};i.onkeydown=function(a){var b=a||window.event;if(b.keyCode==9){f.cancelEvent(b);var c=w(b);if(c.el){a=c.el.parentNode;c=x(c.el);var e=x(a),k=a.parentNode.childNodes.length,g=a.childNodes.length;
 b=b.shiftKey;for(var h=false,j=c,l;;){for(;b?j>=0:j<g;j=b?j-1:j+1)for(l=j==c&&!h?b?e-1:e+1:b?k-1:0;b?l>=0:l<k;l=b?l-1:l+1){if(j==c&&l==e)return;a=a.parentNode.childNodes[l];var n=$(a.childNodes[j]).find(":input");if(n.size()>0){setTimeout(function(){n.focus()},0);return}}j=b?g-1:0;h=true}}}else if(b.keyCode>=37&&b.keyCode<=40){h=f.target(b);function m(s){return f.hasTag(s,"INPUT")&&s.type=="text"||f.hasTag(s,"TEXTAREA")}if(!f.hasTag(h,"SELECT")){c=w(b);if(c.el){a=c.el.parentNode;c=x(c.el);e=x(a);
-k=a.parentNode.childNodes.length;g=a.childNodes.length;switch(b.keyCode){case 39:if(m(h)){j=f.getSelectionRange(h);if(j.start!=h.value.length)return}e++;break;case 38:c--;break;case 37:if(m(h)){j=f.getSelectionRange(h);if(j.start!=0)return}e--;break;case 40:c++;break;default:return}f.cancelEvent(b);if(c>-1&&c<g&&e>-1&&e<k){a=a.parentNode.childNodes[e];n=$(a.childNodes[c]).find(":input");n.size()>0&&setTimeout(function(){n.focus()},0)}}}}};this.autoJavaScript=function(){if(i.parentNode==null){i=d=
+k=a.parentNode.childNodes.length;g=a.childNodes.length;switch(b.keyCode){case 39:if(m(h)){j=f.getSelectionRange(h);if(j.start!=h.value.length)return}e++;break;case 38:c--;break;case 37:if(m(h)){j=f.getSelectionRange(h);if(j.start!=0)return}e--;break;case 40:c++;break;default:return}f.cancelEvent(b);if(c>-1&&c<g&&e>-1&&e<k){a=a.parentNode.childNodes[e];n=$(a.childNodes[c]).find(":input");n.size()>0&&setTimeout(function(){n.focus()},0)}}}}};var I=[];function J(a){var b=I.pop();b||(b=document.createElement("div"));b.className="Wt-tv-c";b.style.height=a;return b}function K(a,b,c){var e=a.wtFirstRow,k,g=C()+"px";if(typeof e==="undefined")e=b;for(k=e+a.childNodes.length-1;e<b&&e<=k;++e)I.push(a.removeChild(a.firstChild));for(;k>c&&k>=e;--k)I.push(a.removeChild(a.lastChild));if(k<e){e=b;k=b-1}for(;e>b;--e)a.insertBefore(J(g),a.firstChild);for(;k<c;++k)a.appendChild(J(g));a.wtFirstRow=b;if(I.length>1E3)I.length=1E3}function L(a,b){if(b instanceof Array){a.className="Wt-tv-c "+b[1];b=b[0]}else a.className="Wt-tv-c";$(a).text(b)}this.updateCells=function(a,b,c){var e=[d.firstChild.firstChild,p.firstChild.firstChild],k={},g,h,j,l,n,m,s;for(h=0;h<2;++h)for(g=e[h].firstChild;g;g=g.nextSibling){k[g.className.split(" ")[0].substring(7)]=g;K(g,a,b)}h=0;for(j=c.length;h<j;++h){e=c[h];var t=e[1],M=e[2];l=0;for(n=t.length;l<n;++l)if(g=k[t[l]]){m=0;for(s=M.length;m<s;++m){var N=g.childNodes[e[0]+m-a];N&&L(N,M[m][l])}}}};this.autoJavaScript=function(){if(i.parentNode==null){i=d=
 o=null;this.autoJavaScript=function(){}}else if(!f.isHidden(i)){if(!f.isIE&&(u!=d.scrollTop||v!=d.scrollLeft)){o.scrollLeft=d.scrollLeft=v;p.scrollTop=d.scrollTop=u}var a=i.offsetWidth-f.px(i,"borderLeftWidth")-f.px(i,"borderRightWidth"),b=d.offsetWidth-d.clientWidth;a-=b;a-=p.clientWidth;if(a>200&&a!=d.tw){d.tw=a;d.style.width=a+b+"px";o.style.width=a+"px";if(!f.isIE)o.style.marginRight=b+"px"}a=d.offsetHeight-d.clientHeight;if((b=p.style)&&b.marginBottom!==a+"px"){b.marginBottom=a+"px";r.layouts2.adjust(i.children[0].id,
 [[1,0]])}}}});
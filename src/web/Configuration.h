@@ -130,6 +130,8 @@ public:
   int bootstrapTimeout() const;
   int indicatorTimeout() const;
   int serverPushTimeout() const;
+  int serverPushCoalescing() const;
+  int sessionShards() const;
   std::string valgrindPath() const;
   ErrorReporting errorReporting() const;
   bool debug() const;
@@ -201,6 +203,8 @@ private:
   int             bootstrapTimeout_;
   int		  indicatorTimeout_;
   int             serverPushTimeout_;
+  int             serverPushCoalescing_;
+  int             sessionShards_;
   std::string     valgrindPath_;
   ErrorReporting  errorReporting_;
   std::string     runDirectory_;
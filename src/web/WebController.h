@@ -11,6 +11,13 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <queue>
+#include <time.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/detail/atomic_count.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/unordered_map.hpp>
 
 #include <Wt/WDllDefs.h>
 #include <Wt/WServer>
@@ -102,11 +109,28 @@ public:
 
 #ifndef WT_CNOR
   bool handleApplicationEvent(const ApplicationEvent& event);
+
+  void postAll(const std::set<std::string>& sessionIds,
+	       const boost::function<void ()>& function,
+	       const WServer::BroadcastCallback& doneFunction);
+  void postAll(const WServer::SessionFilter& filter,
+	       const boost::function<void ()>& function,
+	       const WServer::BroadcastCallback& doneFunction);
 #endif // WT_CNOR
 
   bool expireSessions();
   void shutdown();
 
+  struct ExpiryStatistics {
+    ::int64_t passes;
+    ::int64_t expired;
+    ::int64_t lastDuration;  // microseconds
+    ::int64_t maxDuration;   // microseconds
+    ::int64_t totalDuration; // microseconds
+  };
+
+  ExpiryStatistics expiryStatistics() const;
+
   static std::string sessionFromCookie(std::string cookies,
 				       std::string scriptName,
 				       int sessionIdLength);
@@ -126,11 +150,16 @@ public:
 			    const std::string& newSessionId);
   std::string generateNewSessionId(boost::shared_ptr<WebSession> session);
 
+  // called by a session (with its lock held) when its expire time changed
+  void rescheduleExpiry(WebSession *session);
+
 private:
   Configuration& conf_;
   std::string singleSessionId_;
+  bool singleSession_;
   bool autoExpire_;
-  int plainHtmlSessions_, ajaxSessions_;
+  boost::detail::atomic_count sessionCount_;
+  boost::detail::atomic_count plainHtmlSessions_, ajaxSessions_;
   std::string redirectSecret_;
 
 #ifdef WT_THREADED
@@ -138,18 +167,84 @@ private:
 #endif // WT_THREADED
   std::set<std::string> uploadProgressUrls_;
 
-  typedef std::map<std::string, boost::shared_ptr<WebSession> > SessionMap;
-  SessionMap sessions_;
+  typedef boost::unordered_map<std::string, boost::shared_ptr<WebSession> >
+    SessionMap;
+
+  /*
+   * A scheduled expiry check. Entries are not removed when a session
+   * is touched: an entry is stale (and skipped) unless its time
+   * matches the session's expiryScheduled_.
+   */
+  struct Expiry {
+    time_t time;
+    std::string sessionId;
+
+    Expiry(time_t aTime, const std::string& aSessionId)
+      : time(aTime), sessionId(aSessionId) { }
+
+    bool operator> (const Expiry& other) const { return time > other.time; }
+  };
+
+  typedef std::priority_queue<Expiry, std::vector<Expiry>,
+			      std::greater<Expiry> > ExpiryQueue;
+
+  /*
+   * The sessions are distributed over a number of shards, based on a
+   * hash of the session id, each protected by its own mutex.
+   */
+  struct SessionShard {
+#ifdef WT_THREADED
+    boost::mutex mutex;
+#endif // WT_THREADED
+    SessionMap sessions;
+    ExpiryQueue expiries;
+  };
+
+  int shardCount_;
+  boost::scoped_array<SessionShard> shards_;
+
+  SessionShard& shard(const std::string& sessionId);
+  boost::shared_ptr<WebSession> findSession(const std::string& sessionId);
+  void insertSession(const std::string& sessionId,
+		     boost::shared_ptr<WebSession> session);
+  void sessionRemoved(WebSession& session);
+  void scheduleExpiry(SessionShard& shard, WebSession& session,
+		      const std::string& sessionId);
+
+#ifndef WT_CNOR
+  /*
+   * The state of a postAll(), shared by its batches.
+   */
+  struct Broadcast {
+    std::vector<boost::shared_ptr<WebSession> > sessions;
+    boost::function<void ()> function;
+    WServer::BroadcastCallback doneFunction;
+    boost::posix_time::ptime start;
+    int batches, missed;
+    boost::detail::atomic_count pending, delivered, dead;
+
+    Broadcast() : batches(0), missed(0), pending(0), delivered(0), dead(0) { }
+  };
+
+  void broadcast(boost::shared_ptr<Broadcast> broadcast);
+  void handleBroadcast(boost::shared_ptr<Broadcast> broadcast,
+		       std::size_t begin, std::size_t end);
+#endif // WT_CNOR
+
+  ExpiryStatistics expiryStatistics_;
+#ifdef WT_THREADED
+  mutable boost::mutex expiryStatisticsMutex_;
+#endif // WT_THREADED
 
 #ifdef WT_THREADED
-  // mutex to protect access to the sessions map and plain/ajax session
-  // counts
-  boost::recursive_mutex mutex_;
+  // mutex to protect singleSessionId_, and to serialize the creation
+  // of the single session. Only used in dedicated-process mode.
+  boost::mutex singleSessionMutex_;
 
   SocketNotifier socketNotifier_;
   // mutex to protect access to notifier maps. This cannot be protected
-  // by mutex_ as this lock is grabbed while the application lock is
-  // being held, which would potentially deadlock if we took mutex_.
+  // by a session shard mutex as this lock is grabbed while the
+  // application lock is being held, which would potentially deadlock.
   boost::recursive_mutex notifierMutex_;
   SocketNotifierMap socketNotifiersRead_;
   SocketNotifierMap socketNotifiersWrite_;
@@ -16,6 +16,7 @@
 
 namespace Wt {
 
+class Configuration;
 class WebRequest;
 class WebResponse;
 class WebStream;
@@ -79,6 +80,15 @@ public:
 
   bool checkResponsePuzzle(const WebRequest& request);
 
+  // serves the session-independent part of the main script, by its hash
+  // and the variant it was expanded for
+  static void serveBootScript(WebResponse& response, Configuration& conf,
+			      const std::string& hash,
+			      const std::string& variant);
+
+  // the number of expanded scripts kept by serveBootScript()
+  static std::size_t bootScriptCacheSize();
+
 private:
   struct CookieValue {
     std::string value;
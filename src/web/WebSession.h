@@ -256,6 +256,7 @@ private:
   void handleWebSocketRequest(Handler& handler);
   static void handleWebSocketMessage(boost::weak_ptr<WebSession> session);
   static void webSocketReady(boost::weak_ptr<WebSession> session);
+  static void deferredPush(boost::weak_ptr<WebSession> session);
 
   void checkTimers();
   void hibernate();
@@ -293,6 +294,9 @@ private:
 
 #ifndef WT_TARGET_JAVA
   Time             expire_;
+  // the time of the pending expiry check, guarded by the controller's
+  // session shard mutex
+  time_t           expiryScheduled_;
 #endif
 
 #ifdef WT_BOOST_THREADS
@@ -306,6 +310,12 @@ private:
 #endif
   bool             updatesPending_, triggerUpdate_;
 
+#ifndef WT_TARGET_JAVA
+  // for coalescing server push updates
+  Time             lastPush_;
+  bool             pushScheduled_;
+#endif // WT_TARGET_JAVA
+
   WEnvironment  embeddedEnv_;
   WEnvironment *env_;
   WApplication *app_;
@@ -351,6 +361,7 @@ private:
 
   friend class WebSocketMessage;
   friend class WebRenderer;
+  friend class WebController;
 };
 
 struct WEvent::Impl {
@@ -1847,6 +1847,14 @@ _$_$endif_$_();
 
 })();
 
+/*
+ * Everything below is instantiated per session by calling
+ * _$_APP_CLASS_$_Boot(), so that this script does not depend on
+ * the session and can be cached.
+ */
+window._$_APP_CLASS_$_Boot = function(bootDeployPath, bootSessionUrl,
+				      bootAckUpdateId, bootParams) {
+
 if (window._$_APP_CLASS_$_) {
   try {
     window._$_APP_CLASS_$_._p_.quit();
@@ -1862,7 +1870,7 @@ var WT = _$_WT_CLASS_$_;
 var downX = 0;
 var downY = 0;
 
-var deployUrl = _$_DEPLOY_PATH_$_;
+var deployUrl = bootDeployPath;
 
 function saveDownPos(e) {
   var coords = WT.pageCoordinates(e);
@@ -2478,7 +2486,7 @@ function setSessionUrl(url) {
     comm.setUrl(url);
 }
 
-setSessionUrl(_$_SESSION_URL_$_);
+setSessionUrl(bootSessionUrl);
 
 var comm = WT.initAjaxComm(sessionUrl, handleResponse);
 
@@ -2652,7 +2660,7 @@ _$_$endif_$_();
   }
 }
 
-var ackUpdateId = _$_ACK_UPDATE_ID_$_, ackPuzzle = null;
+var ackUpdateId = bootAckUpdateId, ackPuzzle = null;
 function responseReceived(updateId, puzzle) {
   ackPuzzle = puzzle;
   ackUpdateId = updateId;
@@ -2724,9 +2732,8 @@ function sendUpdate() {
     data.result += '&ackPuzzle=' + encodeURIComponent(solution);
   }
 
-  var params = "_$_PARAMS_$_";
-  if (params.length > 0)
-    data.result += '&' + params;
+  if (bootParams.length > 0)
+    data.result += '&' + bootParams;
 
   if (websocket.socket != null && websocket.socket.readyState == 1) {
     responsePending = null;
@@ -3066,3 +3073,5 @@ window._$_APP_CLASS_$_SignalEmit = _$_APP_CLASS_$_.emit;
 window._$_APP_CLASS_$_OnLoad = function() {
   _$_APP_CLASS_$_._p_.load();
 };
+
+};
@@ -60,7 +60,7 @@ e+="?_=";_$_$endif_$_();_$_$ifnot_UGLY_INTERNAL_PATHS_$_();e=e.substr(0,e.length
 n+"</div></body></html>";try{s=x.contentWindow.document;s.open();s.write(n);s.close();return true}catch(B){return false}}function l(){var n,s,B,F;if(!x.contentWindow||!x.contentWindow.document)setTimeout(l,10);else{n=x.contentWindow.document;B=(s=n.getElementById("state"))?s.innerText:null;F=a();setInterval(function(){var U,C;n=x.contentWindow.document;U=(s=n.getElementById("state"))?s.innerText:null;C=a();if(U!==B){B=U;i(B);C=B?B:o;F=location.hash=C;b()}else if(C!==F){F=C;h(C)}},50);D=true;w!=null&&
 w()}}function k(){if(!r){var n=a(),s=history.length;G&&clearInterval(G);G=setInterval(function(){var B,F;B=a();F=history.length;if(B!==n){n=B;s=F;i(n);b()}else if(F!==s&&t){n=B;s=F;B=I[s-1];i(B);b()}},50)}}function q(){var n;n=u.value.split("|");if(n.length>1){o=n[0];H=n[1]}else o=H="";if(n.length>2)I=n[2].split(",");if(r)l();else{k();D=true;w!=null&&w()}}var t=false,r=g.isIElt9,y=false,w=null,x=null,u=null,D=false,G=null,I=[],o,H,ba=[];return{_initialize:function(){u!=null&&q()},_initTimeout:function(){k()},
 register:function(n,s){if(!D)H=o=escape(n);ba.push(s)},initialize:function(n,s){if(!D){var B=navigator.vendor||"";if(B!=="KDE")if(typeof window.opera!=="undefined")y=true;else if(!r&&B.indexOf("Apple Computer, Inc.")>-1)t=true;if(typeof n==="string")n=document.getElementById(n);if(!(!n||n.tagName.toUpperCase()!=="TEXTAREA"&&(n.tagName.toUpperCase()!=="INPUT"||n.type!=="hidden"&&n.type!=="text"))){u=n;if(r){if(typeof s==="string")s=document.getElementById(s);!s||s.tagName.toUpperCase()!=="IFRAME"||
-(x=s)}}}},navigate:function(n,s){n=ha(n);if(D){n=n;if(r)h(n);else{if(n.length>0)location.hash=n;if(t){I[history.length]=n;b()}}s&&e()}},getCurrentState:function(){if(!D)return"";return unescape(H)}}}()});if(window._$_APP_CLASS_$_)try{window._$_APP_CLASS_$_._p_.quit()}catch(e$$29){}
+(x=s)}}}},navigate:function(n,s){n=ha(n);if(D){n=n;if(r)h(n);else{if(n.length>0)location.hash=n;if(t){I[history.length]=n;b()}}s&&e()}},getCurrentState:function(){if(!D)return"";return unescape(H)}}}()});window._$_APP_CLASS_$_Boot=function(bootDeployPath,bootSessionUrl,bootAckUpdateId,bootParams){if(window._$_APP_CLASS_$_)try{window._$_APP_CLASS_$_._p_.quit()}catch(e$$29){}
 window._$_APP_CLASS_$_=new (function(){function L(c){c=o.pageCoordinates(c);H=c.x;ba=c.y}function M(){var c=_$_WT_CLASS_$_.history.getCurrentState();if(!(c!=null&&c.length>0&&c.substr(0,1)!="/"))if(s!=c){s=c;setTimeout(function(){a(null,"hash",null,true)},1)}}function E(c,d){if(!(s==c||!s&&c=="/")){d||(s=c);o.history.navigate(c,d)}}function J(){document.body.ondragstart=function(){return false}}function O(c,d){var f=o.target(d);if(f)if(f.offsetWidth>f.clientWidth||f.offsetHeight>f.clientHeight){var j=
 o.widgetPageCoordinates(f),p=o.pageCoordinates(d),m=p.y-j.y;if(p.x-j.x>f.clientWidth||m>f.clientHeight)return true}f=B;f.object=o.getElement(c.getAttribute("dwid"));if(f.object==null)return true;f.sourceId=c.getAttribute("dsid");f.objectPrevStyle={position:f.object.style.position,display:f.object.style.display,left:f.object.style.left,top:f.object.style.top,className:f.object.className};f.object.parentNode.removeChild(f.object);f.object.style.position="absolute";f.object.className="";f.object.style["z-index"]=
 "1000";document.body.appendChild(f.object);o.capture(null);o.capture(f.object);f.object.onmousemove=X;f.object.onmouseup=ma;f.offsetX=-4;f.offsetY=-4;f.dropTarget=null;f.mimeType=c.getAttribute("dmt");f.xy=o.pageCoordinates(d);o.cancelEvent(d,o.CancelPropagate);return false}function X(c){if(B.object!==null){var d=B,f=o.pageCoordinates(c);if(d.object.style.display!==""&&d.xy.x!==f.x&&d.xy.y!==f.y)d.object.style.display="";d.object.style.left=f.x-d.offsetX+"px";d.object.style.top=f.y-d.offsetY+"px";
@@ -80,12 +80,12 @@ if(!N){_$_$endif_$_();var p={},m=C.length;p.object=c;p.signal=d;p.event=window.f
 500);setTimeout(function(){b()},j)}var f;if(da.indexOf("://")!=-1)f="ws"+da.substr(4);else{f=da.substr(da.indexOf("?"));f="ws"+location.protocol.substr(4)+"//"+location.host+n+f}f+="&request=ws";A.socket=typeof window.WebSocket!=="undefined"?(c=new WebSocket(f)):(c=new MozWebSocket(f));A.keepAlive&&clearInterval(A.keepAlive);A.keepAlive=null;c.onmessage=function(j){A.reconnectTries=0;A.state=1;K(0,j.data,null)};c.onerror=function(){if(reconnectTries==3&&A.state==0)A.state=2;d()};c.onclose=function(){if(A.reconnectTries==
 3&&A.state==0)A.state=2;d()};c.onopen=function(){A.keepAlive=setInterval(function(){if(c.readyState==1)c.send("&signal=ping");else{clearInterval(A.keepAlive);A.keepAlive=null}},_$_SERVER_PUSH_TIMEOUT_$_)}}if(c.readyState==1){h();return}}_$_$endif_$_();if(N!=null&&V!=null){clearTimeout(V);N.abort();N=null}if(N==null)if(ca==null){ca=setTimeout(function(){h()},o.updateDelay);wa=(new Date).getTime()}else if(la){clearTimeout(ca);h()}else if((new Date).getTime()-wa>o.updateDelay){clearTimeout(ca);h()}}}
 function e(c,d){sa=d;ta=c;pa.responseReceived(c)}function i(c){xa=c}function h(){if(I!=window._$_APP_CLASS_$_)S();else if(!N){ca=null;if(Q){if(!ya){if(confirm("The application was quited, do you want to restart?"))document.location=document.location;ya=true}}else{var c,d,f;if(C.length>0){c=g();d=c.feedback?setTimeout(T,_$_INDICATOR_TIMEOUT_$_):null;f=false}else{c={result:"&signal=poll"};d=null;f=true}c.result+="&ackId="+ta+"&pageId="+xa;if(sa){var j="",p=$("#"+sa).get(0);if(p)for(p=p.parentNode;!o.hasTag(p,
-"BODY");p=p.parentNode)if(p.id){if(j!="")j+=",";j+=p.id}c.result+="&ackPuzzle="+encodeURIComponent(j)}c.result+="&_$_PARAMS_$_";if(A.socket!=null&&A.socket.readyState==1){N=null;d!=null&&clearTimeout(d);f||A.socket.send(c.result)}else{N=pa.sendUpdate("request=jsupdate"+c.result,d,ta,-1);V=f?setTimeout(R,_$_SERVER_PUSH_TIMEOUT_$_):null}}}}function l(c,d,f){if(typeof c.wtWidth==="undefined"||c.wtWidth!=d||typeof c.wtHeight==="undefined"||c.wtHeight!=f){c.wtWidth=d;c.wtHeight=f;d>=0&&f>=0&&k(c,"resized",
+"BODY");p=p.parentNode)if(p.id){if(j!="")j+=",";j+=p.id}c.result+="&ackPuzzle="+encodeURIComponent(j)}if(bootParams.length>0)c.result+="&"+bootParams;if(A.socket!=null&&A.socket.readyState==1){N=null;d!=null&&clearTimeout(d);f||A.socket.send(c.result)}else{N=pa.sendUpdate("request=jsupdate"+c.result,d,ta,-1);V=f?setTimeout(R,_$_SERVER_PUSH_TIMEOUT_$_):null}}}}function l(c,d,f){if(typeof c.wtWidth==="undefined"||c.wtWidth!=d||typeof c.wtHeight==="undefined"||c.wtHeight!=f){c.wtWidth=d;c.wtHeight=f;d>=0&&f>=0&&k(c,"resized",
 d,f)}}function k(c,d){var f={},j=C.length;f.signal="user";f.id=typeof c==="string"?c:c==I?"app":c.id;if(typeof d==="object"){f.name=d.name;f.object=d.eventObject;f.event=d.event}else{f.name=d;f.object=f.event=null}f.args=[];for(var p=2;p<arguments.length;++p){var m=arguments[p];m=m===false?0:m===true?1:m.toDateString?m.toDateString():m;f.args[p-2]=m}f.feedback=true;C[j]=ha(f,j);b()}function q(c,d,f){var j=function(){var m=o.getElement(c);if(m){if(f)m.timer=setTimeout(m.tm,d);else{m.timer=null;m.tm=
 null}m.onclick&&m.onclick()}},p=o.getElement(c);p.timer=setTimeout(j,d);p.tm=j}function t(c,d){setTimeout(function(){if(ea[c]===true)d();else ea[c]=d},20)}function r(c){if(ea[c]!==true){typeof ea[c]!=="undefined"&&ea[c]();ea[c]=true}}function y(c,d,f){function j(){var z=f===undefined?o.isIE?1:2:f;if(z>1)y(c,d,z-1);else{alert("Fatal error: failed loading "+c);S()}}var p=false;if(d!="")try{p=!eval("typeof "+d+" === 'undefined'")}catch(m){p=false}if(p)r(c);else{var v=document.createElement("script");
 v.setAttribute("src",c);v.onload=function(){r(c)};v.onerror=j;v.onreadystatechange=function(){var z=v.readyState;if(z=="loaded")o.isOpera||o.isIE?r(c):j();else z=="complete"&&r(c)};document.getElementsByTagName("head")[0].appendChild(v)}}function w(c,d){this.callback=d;this.work=c.length;this.images=[];if(c.length==0)d(this.images);else for(d=0;d<c.length;d++)this.preload(c[d])}function x(c,d){this.callback=d;this.work=c.length;this.arrayBuffers=[];if(c.length==0)d(this.arrayBuffers);else for(d=0;d<
-c.length;d++)this.preload(c[d],d)}function u(c){s=c;o.history.register(c,M)}function D(c){if(c.ieAlternativeExecuted)return"0";I.emit(c.parentNode,"IeAltnernative");c.style.width="";c.ieAlternativeExecuted=true;return"0"}function G(c){window.onbeforeunload=c&&c!=""?function(d){if(d=d||window.event)d.returnValue=c;return c}:null}var I=this,o=_$_WT_CLASS_$_,H=0,ba=0,n=_$_DEPLOY_PATH_$_,s=null,B={object:null,sourceId:null,mimeType:null,dropOffsetX:null,dragOffsetY:null,dropTarget:null,objectPrevStyle:null,
-xy:null},F=[],U=[],C=[],da,Q=false,ya=false,ua=false,N=null,V=null,ka=null,la=0,va=false,ca=null,oa=null,A={state:0,socket:null,keepAlive:null,reconnectTries:0},qa=false;fa(_$_SESSION_URL_$_);var pa=o.initAjaxComm(da,K),ra=false,wa,ta=_$_ACK_UPDATE_ID_$_,sa=null,xa=0,ea={};w.prototype.preload=function(c){var d=new Image;this.images.push(d);d.onload=w.prototype.onload;d.onerror=w.prototype.onload;d.onabort=w.prototype.onload;d.imagePreloader=this;d.src=c};w.prototype.onload=function(){var c=this.imagePreloader;
+c.length;d++)this.preload(c[d],d)}function u(c){s=c;o.history.register(c,M)}function D(c){if(c.ieAlternativeExecuted)return"0";I.emit(c.parentNode,"IeAltnernative");c.style.width="";c.ieAlternativeExecuted=true;return"0"}function G(c){window.onbeforeunload=c&&c!=""?function(d){if(d=d||window.event)d.returnValue=c;return c}:null}var I=this,o=_$_WT_CLASS_$_,H=0,ba=0,n=bootDeployPath,s=null,B={object:null,sourceId:null,mimeType:null,dropOffsetX:null,dragOffsetY:null,dropTarget:null,objectPrevStyle:null,
+xy:null},F=[],U=[],C=[],da,Q=false,ya=false,ua=false,N=null,V=null,ka=null,la=0,va=false,ca=null,oa=null,A={state:0,socket:null,keepAlive:null,reconnectTries:0},qa=false;fa(bootSessionUrl);var pa=o.initAjaxComm(da,K),ra=false,wa,ta=bootAckUpdateId,sa=null,xa=0,ea={};w.prototype.preload=function(c){var d=new Image;this.images.push(d);d.onload=w.prototype.onload;d.onerror=w.prototype.onload;d.onabort=w.prototype.onload;d.imagePreloader=this;d.src=c};w.prototype.onload=function(){var c=this.imagePreloader;
 --c.work==0&&c.callback(c.images)};x.prototype.preload=function(c,d){var f=new XMLHttpRequest;f.open("GET",c,true);f.responseType="arraybuffer";f.arrayBuffers=this.arrayBuffers;f.preloader=this;f.index=d;f.uri=c;f.onload=function(){console.log("XHR load buffer "+this.index+" from uri "+this.uri);this.arrayBuffers[this.index]=this.response;this.preloader.afterLoad()};f.onerror=x.prototype.afterload;f.onabort=x.prototype.afterload;f.send()};x.prototype.afterLoad=function(){--this.work==0&&this.callback(this.arrayBuffers)};
 window.onunload=function(){if(!Q){I.emit(I,"Wt-unload");b();h()}};this._p_={ieAlternative:D,loadScript:y,onJsLoad:t,setTitle:P,update:a,quit:S,setSessionUrl:fa,setFormObjects:function(c){F=c},saveDownPos:L,addTimerEvent:q,load:Y,setServerPush:Z,dragStart:O,dragDrag:X,dragEnd:ma,capture:o.capture,enableInternalPaths:u,onHashChange:M,setHash:E,ImagePreloader:w,ArrayBufferPreloader:x,doAutoJavaScript:ja,autoJavaScript:function(){},response:e,setPage:i,setCloseMessage:G,propagateSize:l};this.WT=_$_WT_CLASS_$_;
-this.emit=k});window._$_APP_CLASS_$_SignalEmit=_$_APP_CLASS_$_.emit;window._$_APP_CLASS_$_OnLoad=function(){_$_APP_CLASS_$_._p_.load()};
+this.emit=k});window._$_APP_CLASS_$_SignalEmit=_$_APP_CLASS_$_.emit;window._$_APP_CLASS_$_OnLoad=function(){_$_APP_CLASS_$_._p_.load()}};